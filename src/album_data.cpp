@@ -0,0 +1,64 @@
+#include "album_data.h"
+
+#include <fstream>
+
+bool ReadAlbumData(std::istream& in, std::vector<AlbumRecord>& records)
+{
+    std::string line;
+    AlbumRecord current;
+    bool haveTitle = false;
+
+    while (std::getline(in, line)) {
+        if (!line.empty() && line[line.size() - 1] == '\r') {
+            line.erase(line.size() - 1);
+        }
+
+        if (line == "END_ALBUM") {
+            if (haveTitle) {
+                records.push_back(current);
+            }
+            current = AlbumRecord();
+            haveTitle = false;
+        } else if (!haveTitle) {
+            current.title = line;
+            haveTitle = true;
+        } else {
+            current.photoPaths.push_back(line);
+        }
+    }
+
+    return !in.bad();
+}
+
+bool ReadAlbumDataFile(const std::string& path, std::vector<AlbumRecord>& records)
+{
+    std::ifstream file(path.c_str());
+    if (!file.is_open()) {
+        return false;
+    }
+
+    return ReadAlbumData(file, records);
+}
+
+bool WriteAlbumData(std::ostream& out, const std::vector<AlbumRecord>& records)
+{
+    for (size_t i = 0; i < records.size(); ++i) {
+        out << records[i].title << "\n";
+        for (size_t j = 0; j < records[i].photoPaths.size(); ++j) {
+            out << records[i].photoPaths[j] << "\n";
+        }
+        out << "END_ALBUM\n";
+    }
+
+    return out.good();
+}
+
+bool WriteAlbumDataFile(const std::string& path, const std::vector<AlbumRecord>& records)
+{
+    std::ofstream file(path.c_str());
+    if (!file.is_open()) {
+        return false;
+    }
+
+    return WriteAlbumData(file, records);
+}
@@ -0,0 +1,22 @@
+#ifndef ALBUM_DATA_H
+#define ALBUM_DATA_H
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// One album as stored in album_data.txt: a title line, one line per photo
+// path, then an END_ALBUM line.
+struct AlbumRecord
+{
+    std::string title;
+    std::vector<std::string> photoPaths;
+};
+
+bool ReadAlbumData(std::istream& in, std::vector<AlbumRecord>& records);
+bool ReadAlbumDataFile(const std::string& path, std::vector<AlbumRecord>& records);
+
+bool WriteAlbumData(std::ostream& out, const std::vector<AlbumRecord>& records);
+bool WriteAlbumDataFile(const std::string& path, const std::vector<AlbumRecord>& records);
+
+#endif
@@ -0,0 +1,700 @@
+#include <wx/sizer.h>
+#include <wx/filedlg.h>
+#include <wx/grid.h>
+#include <wx/rawbmp.h>
+#include <algorithm> 
+
+#include "album_frames.h"
+#include "album_library.h"
+
+wxBEGIN_EVENT_TABLE(MyFrame, wxFrame)
+    EVT_BUTTON(ID_CreateAlbum, MyFrame::OnCreateAlbum)
+    EVT_BUTTON(ID_AddPhoto, MyFrame::OnAddPhoto)
+    EVT_BUTTON(ID_RemovePhoto, MyFrame::OnRemovePhoto)
+    EVT_BUTTON(ID_Next, MyFrame::OnNext)
+    EVT_BUTTON(ID_Back, MyFrame::OnBack)
+    EVT_TIMER(ID_Timer, MyFrame::OnTimer)
+wxEND_EVENT_TABLE()
+
+wxBEGIN_EVENT_TABLE(AlbumFrame, wxFrame)
+    EVT_BUTTON(ID_AddPhoto, AlbumFrame::OnAddPhoto)
+    EVT_BUTTON(ID_BackToMain, AlbumFrame::OnBackToMain)  
+wxEND_EVENT_TABLE()
+
+wxBEGIN_EVENT_TABLE(PhotoEditorFrame, wxFrame)
+    EVT_SLIDER(ID_BrightnessSlider, PhotoEditorFrame::OnBrightnessChange)
+    EVT_SLIDER(ID_SaturationSlider, PhotoEditorFrame::OnSaturationChange)
+    EVT_SLIDER(ID_ContrastSlider, PhotoEditorFrame::OnContrastChange)  
+wxEND_EVENT_TABLE()
+
+MyFrame::MyFrame(const wxString& title, const wxString& dataFile)
+    : wxFrame(NULL, wxID_ANY, title, wxDefaultPosition, wxSize(800, 600)),
+      dataFilePath(dataFile), currentStartIndex(0), hoverPhoto(NULL), originalY(0)
+{
+    
+    mainSizer = new wxBoxSizer(wxVERTICAL);
+
+    
+    wxButton* createAlbumButton = new wxButton(this, ID_CreateAlbum, "Create New Album");
+    mainSizer->Add(createAlbumButton, 0, wxALL | wxALIGN_CENTER_HORIZONTAL, 10);
+
+    
+    albumGridSizer = new wxGridSizer(0, 3, 10, 10);  
+    mainSizer->Add(albumGridSizer, 1, wxEXPAND | wxALL, 10);
+
+    photoSizer = new wxGridSizer(0, 3, 10, 10);  
+
+    mainSizer->Add(photoSizer, 1, wxEXPAND | wxALL, 10);
+    SetSizer(mainSizer);
+    Layout();
+    hoverTimer = new wxTimer(this, ID_Timer);
+    LoadAlbumData();
+}
+
+void MyFrame::OnCreateAlbum(wxCommandEvent& event)
+{
+    CreateAlbumDialog createAlbumDialog(this);
+    if (createAlbumDialog.ShowModal() == wxID_OK)
+    {
+        wxString title = createAlbumDialog.GetAlbumTitle();
+        wxImage cover = createAlbumDialog.GetAlbumCover();
+
+        if (!cover.IsOk())
+        {
+            wxMessageBox("Failed to load album cover.", "Error", wxOK | wxICON_ERROR);
+            return;
+        }
+
+
+        std::vector<wxBitmap> newAlbum;
+        std::vector<wxString> newPaths;
+        wxBitmap coverBitmap(cover);
+        newAlbum.push_back(coverBitmap);
+        newPaths.push_back(wxString()); 
+        albums.push_back(newAlbum);
+        albumPaths.push_back(newPaths);
+        albumTitles.push_back(title);
+
+        UpdateAlbumDisplay();
+        SaveAlbumData(); 
+    }
+}
+
+void MyFrame::UpdateAlbumDisplay()
+{
+
+    for (size_t i = 0; i < albumWidgets.size(); ++i)
+    {
+        albumGridSizer->Detach(albumWidgets[i]);
+        albumWidgets[i]->Destroy();
+    }
+    albumWidgets.clear();
+
+    for (size_t i = 0; i < albums.size(); ++i)
+    {
+        wxBoxSizer* albumBoxSizer = new wxBoxSizer(wxVERTICAL);
+
+        wxStaticText* albumTitle = new wxStaticText(this, wxID_ANY, albumTitles[i], wxDefaultPosition, wxSize(100, 20), wxALIGN_CENTER);
+        albumBoxSizer->Add(albumTitle, 0, wxALIGN_CENTER_HORIZONTAL | wxBOTTOM, 5);
+        
+        wxStaticBitmap* albumCoverWidget = new wxStaticBitmap(this, wxID_ANY, albums[i][0], wxDefaultPosition, wxSize(100, 100));
+        albumCoverWidget->Bind(wxEVT_LEFT_DOWN, &MyFrame::OnAlbumClick, this);
+        albumBoxSizer->Add(albumCoverWidget, 0, wxALIGN_CENTER_HORIZONTAL);
+
+        albumGridSizer->Add(albumBoxSizer, 0, wxEXPAND);
+        albumWidgets.push_back(albumCoverWidget);
+    }
+
+    Layout();
+}
+
+void MyFrame::OnAlbumClick(wxMouseEvent& event)
+{
+    wxStaticBitmap* clickedAlbum = static_cast<wxStaticBitmap*>(event.GetEventObject());
+    size_t index = std::distance(albumWidgets.begin(), std::find(albumWidgets.begin(), albumWidgets.end(), clickedAlbum));
+
+    if (index < albums.size())
+    {
+        currentAlbum = albums[index];
+        currentPaths = albumPaths[index];
+        currentAlbumTitle = albumTitles[index];
+        ShowAlbumPage(currentAlbumTitle, currentAlbum, currentPaths);
+    }
+}
+
+void MyFrame::ShowAlbumPage(const wxString& title, std::vector<wxBitmap>& photos, std::vector<wxString>& photoPaths)
+{
+    AlbumFrame* albumFrame = new AlbumFrame(title, photos, photoPaths, this);
+    albumFrame->Show();
+    this->Hide();  
+}
+
+void MyFrame::OnAddPhoto(wxCommandEvent& event)
+{
+    wxFileDialog openFileDialog(this, _("Open Image file"), "", "",
+        "Image files (*.png;*.jpg;*.jpeg)|*.png;*.jpg;*.jpeg", wxFD_OPEN | wxFD_FILE_MUST_EXIST);
+
+    if (openFileDialog.ShowModal() == wxID_CANCEL)
+        return; 
+
+    wxString path = openFileDialog.GetPath();
+
+    wxBitmap photo;
+    photo.LoadFile(path, wxBITMAP_TYPE_ANY);
+
+    if (photo.IsOk())
+    {
+        currentAlbum.push_back(photo);
+        currentPaths.push_back(path);  
+
+        wxMessageBox("Photo uploaded successfully!\nFile path: " + path, "Upload Confirmation", wxOK | wxICON_INFORMATION);
+
+        UpdatePhotoDisplay();
+        SaveAlbumData(); 
+    }
+    else
+    {
+        wxMessageBox("Failed to load the selected photo.", "Error", wxOK | wxICON_ERROR);
+    }
+}
+
+void MyFrame::OnRemovePhoto(wxCommandEvent& event)
+{
+    if (!currentAlbum.empty()) {
+        currentAlbum.pop_back();
+        currentPaths.pop_back();
+        UpdatePhotoDisplay();
+        SaveAlbumData(); 
+    }
+}
+
+void MyFrame::OnNext(wxCommandEvent& event)
+{
+    if (currentStartIndex + 3 < currentAlbum.size()) {
+        currentStartIndex += 3;
+        UpdatePhotoDisplay();
+    }
+}
+
+void MyFrame::OnBack(wxCommandEvent& event)
+{
+    if (currentStartIndex >= 3) {
+        currentStartIndex -= 3;
+        UpdatePhotoDisplay();
+    }
+}
+
+void MyFrame::UpdatePhotoDisplay()
+{
+    for (size_t i = 0; i < photoWidgets.size(); ++i) {
+        photoSizer->Detach(photoWidgets[i]);
+        photoWidgets[i]->Destroy();
+    }
+    photoWidgets.clear();
+
+    for (int i = 0; i < 3; ++i) {
+        if (currentStartIndex + i < currentAlbum.size()) {
+            wxStaticBitmap* photo = new wxStaticBitmap(this, wxID_ANY, currentAlbum[currentStartIndex + i]);
+
+            photo->Bind(wxEVT_ENTER_WINDOW, &MyFrame::OnPhotoHover, this);
+            photo->Bind(wxEVT_LEAVE_WINDOW, &MyFrame::ResetPhotoPosition, this);
+            photo->Bind(wxEVT_LEFT_DOWN, &MyFrame::OnPhotoClick, this);
+
+            photoSizer->Add(photo, 0, wxEXPAND);
+            photoWidgets.push_back(photo);
+        }
+    }
+
+    Layout();
+}
+
+void MyFrame::OnPhotoHover(wxMouseEvent& event)
+{
+    wxStaticBitmap* photo = static_cast<wxStaticBitmap*>(event.GetEventObject());
+    hoverPhoto = photo;
+    originalY = photo->GetPosition().y;  
+    hoverTimer->Start(50);  
+}
+
+void MyFrame::OnTimer(wxTimerEvent& event)
+{
+    if (hoverPhoto) {
+        static int offset = 0;
+        offset = (offset + 1) % 8;
+        int hopAmount = (offset < 4) ? -2 : 2;  
+        hoverPhoto->Move(hoverPhoto->GetPosition() + wxPoint(0, hopAmount));
+    }
+}
+
+void MyFrame::ResetPhotoPosition(wxMouseEvent& event)
+{
+    if (hoverPhoto) {
+        hoverTimer->Stop();  
+        hoverPhoto->Move(wxPoint(hoverPhoto->GetPosition().x, originalY));  
+        hoverPhoto = NULL;
+    }
+}
+
+void MyFrame::OnPhotoClick(wxMouseEvent& event)
+{
+    wxStaticBitmap* photo = static_cast<wxStaticBitmap*>(event.GetEventObject());
+    wxBitmap bitmap = photo->GetBitmap();
+
+    PhotoEditorFrame* editorFrame = new PhotoEditorFrame(bitmap);
+    editorFrame->Show();
+}
+
+
+AlbumFrame::AlbumFrame(const wxString& title, std::vector<wxBitmap>& photos, std::vector<wxString>& photoPaths, MyFrame* parent)
+    : wxFrame(NULL, wxID_ANY, title, wxDefaultPosition, wxSize(800, 600)), albumPhotos(photos), albumPhotoPaths(photoPaths), parentFrame(parent)
+{
+    mainSizer = new wxBoxSizer(wxVERTICAL);
+    wxBoxSizer* buttonSizer = new wxBoxSizer(wxHORIZONTAL);
+    wxButton* addButton = new wxButton(this, ID_AddPhoto, "Add Photo");
+    buttonSizer->Add(addButton, 0, wxALL, 10);
+
+    wxButton* backButton = new wxButton(this, ID_BackToMain, "Back");
+    buttonSizer->Add(backButton, 0, wxALL, 10);
+    mainSizer->Add(buttonSizer, 0, wxALIGN_LEFT);
+
+    photoSizer = new wxGridSizer(0, 3, 10, 10);  
+    mainSizer->Add(photoSizer, 1, wxEXPAND | wxALL, 10);
+
+    SetSizer(mainSizer);
+    Layout();
+    UpdatePhotoDisplay();
+}
+
+void AlbumFrame::OnAddPhoto(wxCommandEvent& event)
+{
+    wxFileDialog openFileDialog(this, _("Open Image file"), "", "",
+        "Image files (*.png;*.jpg;*.jpeg)|*.png;*.jpg;*.jpeg", wxFD_OPEN | wxFD_FILE_MUST_EXIST);
+
+    if (openFileDialog.ShowModal() == wxID_CANCEL)
+        return; 
+
+    wxString path = openFileDialog.GetPath();
+
+    wxBitmap photo;
+    photo.LoadFile(path, wxBITMAP_TYPE_ANY);
+
+    if (photo.IsOk())
+    {
+        albumPhotos.push_back(photo);
+        albumPhotoPaths.push_back(path);  
+        wxMessageBox("Photo uploaded successfully!\nFile path: " + path, "Upload Confirmation", wxOK | wxICON_INFORMATION);
+
+        UpdatePhotoDisplay();
+        parentFrame->SaveAlbumData(); 
+    }
+    else
+    {
+        wxMessageBox("Failed to load the selected photo.", "Error", wxOK | wxICON_ERROR);
+    }
+}
+
+void AlbumFrame::OnBackToMain(wxCommandEvent& event)
+{
+    parentFrame->Show();  
+    this->Destroy();  
+}
+
+void AlbumFrame::UpdatePhotoDisplay()
+{
+    for (size_t i = 0; i < photoWidgets.size(); ++i)
+    {
+        photoSizer->Detach(photoWidgets[i]);
+        photoWidgets[i]->Destroy();
+    }
+    photoWidgets.clear();
+
+    for (size_t i = 0; i < albumPhotos.size(); ++i)
+    {
+        wxStaticBitmap* photoWidget = new wxStaticBitmap(this, wxID_ANY, albumPhotos[i]);
+        photoWidget->Bind(wxEVT_LEFT_DOWN, &AlbumFrame::OnPhotoClick, this);  
+        photoSizer->Add(photoWidget, 0, wxEXPAND);
+        photoWidgets.push_back(photoWidget);
+    }
+
+    Layout();
+}
+
+void AlbumFrame::OnPhotoClick(wxMouseEvent& event)
+{
+    wxStaticBitmap* photo = static_cast<wxStaticBitmap*>(event.GetEventObject());
+    wxBitmap bitmap = photo->GetBitmap();
+
+    PhotoEditorFrame* editorFrame = new PhotoEditorFrame(bitmap);
+    editorFrame->Show();
+}
+
+
+CreateAlbumDialog::CreateAlbumDialog(wxWindow* parent)
+    : wxDialog(parent, wxID_ANY, "New Album", wxDefaultPosition, wxSize(300, 300))
+{
+    wxBoxSizer* sizer = new wxBoxSizer(wxVERTICAL);
+
+    wxStaticText* titleText = new wxStaticText(this, wxID_ANY, "Title");
+    sizer->Add(titleText, 0, wxALL, 5);
+
+    albumTitle = new wxTextCtrl(this, wxID_ANY);
+    sizer->Add(albumTitle, 0, wxEXPAND | wxALL, 5);
+
+    uploadButton = new wxButton(this, ID_UploadPhoto, "Upload Photo");
+    sizer->Add(uploadButton, 0, wxALIGN_CENTER | wxALL, 10);
+
+    photoPreview = new wxStaticBitmap(this, wxID_ANY, wxBitmap(), wxDefaultPosition, wxSize(100, 100));
+    sizer->Add(photoPreview, 0, wxALIGN_CENTER | wxALL, 10);
+
+    uploadButton->Bind(wxEVT_BUTTON, &CreateAlbumDialog::OnUploadPhoto, this);
+
+    wxButton* okButton = new wxButton(this, wxID_OK, "OK");
+    okButton->SetDefault();
+    wxButton* cancelButton = new wxButton(this, wxID_CANCEL, "Cancel");
+
+    wxBoxSizer* buttonSizer = new wxBoxSizer(wxHORIZONTAL);
+    buttonSizer->Add(okButton, 0, wxALL, 5);
+    buttonSizer->Add(cancelButton, 0, wxALL, 5);
+
+    sizer->Add(buttonSizer, 0, wxALIGN_CENTER);
+
+    SetSizerAndFit(sizer);
+}
+
+void CreateAlbumDialog::OnUploadPhoto(wxCommandEvent& event)
+{
+    wxFileDialog openFileDialog(this, _("Open Image file"), "", "",
+        "Image files (*.png;*.jpg;*.jpeg)|*.png;*.jpg;*.jpeg", wxFD_OPEN | wxFD_FILE_MUST_EXIST);
+
+    if (openFileDialog.ShowModal() == wxID_CANCEL)
+        return; 
+
+    wxString path = openFileDialog.GetPath();
+    coverPhoto.LoadFile(path, wxBITMAP_TYPE_ANY);
+
+    if (!coverPhoto.IsOk())
+    {
+        wxMessageBox("Failed to load photo.", "Error", wxOK | wxICON_ERROR);
+        return;
+    }
+
+    photoPreview->SetBitmap(wxBitmap(coverPhoto));
+    Layout();
+}
+
+
+PhotoEditorFrame::PhotoEditorFrame(wxBitmap bitmap)
+    : wxFrame(NULL, wxID_ANY, "Photo Editor", wxDefaultPosition, wxSize(800, 600)),
+      originalBitmap(bitmap), originalImage(bitmap.ConvertToImage()), backBuffer(0),
+      rawAccessOk(false), displayBitmap(&originalBitmap)
+{
+    if (originalImage.IsOk()) {
+        if (originalImage.HasMask()) {
+            originalImage.InitAlpha();
+        }
+
+        int depth = originalImage.HasAlpha() ? 32 : 24;
+        for (int i = 0; i < 2; ++i) {
+            outputBuffers[i].Create(originalImage.GetWidth(), originalImage.GetHeight(), depth);
+            if (originalImage.HasAlpha()) {
+                outputBuffers[i].UseAlpha();
+            }
+        }
+
+        rawAccessOk = AdjustBrightness(outputBuffers[0], 0);
+        if (!rawAccessOk) {
+            wxLogDebug("Photo editor: raw bitmap access unavailable, adjustments will copy the image");
+        }
+    }
+
+    wxBoxSizer* sizer = new wxBoxSizer(wxVERTICAL);
+
+    photoCanvas = new wxPanel(this, wxID_ANY);
+    photoCanvas->SetMinSize(bitmap.GetSize());
+    photoCanvas->Bind(wxEVT_PAINT, &PhotoEditorFrame::OnPaintPhoto, this);
+    sizer->Add(photoCanvas, 1, wxEXPAND | wxALL, 10);
+
+    brightnessSlider = new wxSlider(this, ID_BrightnessSlider, 0, -100, 100, wxDefaultPosition, wxDefaultSize, wxSL_HORIZONTAL | wxSL_LABELS);
+    sizer->Add(new wxStaticText(this, wxID_ANY, "Brightness"), 0, wxALL, 5);
+    sizer->Add(brightnessSlider, 0, wxEXPAND | wxALL, 10);
+
+    saturationSlider = new wxSlider(this, ID_SaturationSlider, 0, -100, 100, wxDefaultPosition, wxDefaultSize, wxSL_HORIZONTAL | wxSL_LABELS);
+    sizer->Add(new wxStaticText(this, wxID_ANY, "Saturation"), 0, wxALL, 5);
+    sizer->Add(saturationSlider, 0, wxEXPAND | wxALL, 10);
+
+    contrastSlider = new wxSlider(this, ID_ContrastSlider, 0, -100, 100, wxDefaultPosition, wxDefaultSize, wxSL_HORIZONTAL | wxSL_LABELS);
+    sizer->Add(new wxStaticText(this, wxID_ANY, "Contrast"), 0, wxALL, 5);
+    sizer->Add(contrastSlider, 0, wxEXPAND | wxALL, 10);
+
+    SetSizer(sizer);
+    Layout();
+}
+
+// Per-pixel adjustments. Each reads all of its input before writing, so
+// `in` and `out` may point at the same pixel.
+struct BrightnessOp
+{
+    int value;
+
+    void operator()(const unsigned char* in, unsigned char* out) const
+    {
+        for (int c = 0; c < 3; ++c) {
+            out[c] = std::min(std::max(in[c] + value, 0), 255);
+        }
+    }
+};
+
+struct SaturationOp
+{
+    double factor;
+
+    void operator()(const unsigned char* in, unsigned char* out) const
+    {
+        double r = in[0];
+        double g = in[1];
+        double b = in[2];
+
+        double gray = 0.3 * r + 0.59 * g + 0.11 * b;
+
+        out[0] = std::min(std::max(int(gray + factor * (r - gray)), 0), 255);
+        out[1] = std::min(std::max(int(gray + factor * (g - gray)), 0), 255);
+        out[2] = std::min(std::max(int(gray + factor * (b - gray)), 0), 255);
+    }
+};
+
+struct ContrastOp
+{
+    double contrast;
+
+    void operator()(const unsigned char* in, unsigned char* out) const
+    {
+        for (int c = 0; c < 3; ++c) {
+            int newValue = (in[c] - 128) * contrast + 128;
+            out[c] = std::min(std::max(newValue, 0), 255);
+        }
+    }
+};
+
+static void StorePixel(wxNativePixelData::Iterator& p, const unsigned char* rgb, unsigned char)
+{
+    p.Red() = rgb[0];
+    p.Green() = rgb[1];
+    p.Blue() = rgb[2];
+}
+
+static void StorePixel(wxAlphaPixelData::Iterator& p, const unsigned char* rgb, unsigned char alpha)
+{
+#if defined(__WXMSW__) || defined(__WXOSX__)
+    // Raw alpha bitmaps are premultiplied on these ports.
+    p.Red() = rgb[0] * alpha / 255;
+    p.Green() = rgb[1] * alpha / 255;
+    p.Blue() = rgb[2] * alpha / 255;
+#else
+    p.Red() = rgb[0];
+    p.Green() = rgb[1];
+    p.Blue() = rgb[2];
+#endif
+    p.Alpha() = alpha;
+}
+
+template <class PixelData, class PixelOp>
+static bool RenderPixels(const wxImage& source, wxBitmap& target, PixelOp op)
+{
+    PixelData pixels(target);
+    if (!pixels || pixels.GetWidth() != source.GetWidth() || pixels.GetHeight() != source.GetHeight()) {
+        return false;
+    }
+
+    const unsigned char* src = source.GetData();
+    const unsigned char* alpha = source.GetAlpha();
+    unsigned char rgb[3];
+    typename PixelData::Iterator rowStart(pixels);
+
+    for (int y = 0; y < pixels.GetHeight(); ++y) {
+        typename PixelData::Iterator p = rowStart;
+        for (int x = 0; x < pixels.GetWidth(); ++x, ++p, src += 3) {
+            op(src, rgb);
+            StorePixel(p, rgb, alpha ? *alpha++ : 255);
+        }
+        rowStart.OffsetY(pixels, 1);
+    }
+
+    return true;
+}
+
+// Writes the adjusted source into a preallocated bitmap. Returns false if the
+// bitmap cannot be accessed directly, leaving its contents undefined.
+template <class PixelOp>
+static bool RenderToBitmap(const wxImage& source, wxBitmap& target, PixelOp op)
+{
+    if (!source.IsOk() || !target.IsOk()) {
+        return false;
+    }
+
+    if (source.HasAlpha()) {
+        return RenderPixels<wxAlphaPixelData>(source, target, op);
+    }
+    return RenderPixels<wxNativePixelData>(source, target, op);
+}
+
+// Alpha is left untouched, as with the bitmap path.
+template <class PixelOp>
+static void RenderInPlace(wxImage& image, PixelOp op)
+{
+    unsigned char* data = image.GetData();
+    int length = image.GetWidth() * image.GetHeight() * 3;
+
+    for (int i = 0; i < length; i += 3) {
+        op(data + i, data + i);
+    }
+}
+
+void PhotoEditorFrame::OnBrightnessChange(wxCommandEvent& event)
+{
+    int brightness = brightnessSlider->GetValue();
+    if (rawAccessOk) {
+        if (AdjustBrightness(outputBuffers[backBuffer], brightness)) {
+            PresentBackBuffer();
+        }
+    } else if (originalImage.IsOk()) {
+        ShowFallback(AdjustBrightness(originalImage.Copy(), brightness));
+    }
+}
+
+void PhotoEditorFrame::OnSaturationChange(wxCommandEvent& event)
+{
+    int saturation = saturationSlider->GetValue();
+    if (rawAccessOk) {
+        if (AdjustSaturation(outputBuffers[backBuffer], saturation)) {
+            PresentBackBuffer();
+        }
+    } else if (originalImage.IsOk()) {
+        ShowFallback(AdjustSaturation(originalImage.Copy(), saturation));
+    }
+}
+
+void PhotoEditorFrame::OnContrastChange(wxCommandEvent& event)
+{
+    int contrast = contrastSlider->GetValue();
+    if (rawAccessOk) {
+        if (AdjustContrast(outputBuffers[backBuffer], contrast)) {
+            PresentBackBuffer();
+        }
+    } else if (originalImage.IsOk()) {
+        ShowFallback(AdjustContrast(originalImage.Copy(), contrast));
+    }
+}
+
+// Only repaints the canvas: no bitmap is handed to a control, so nothing
+// rebuilds a native image, and the size never changes, so no relayout.
+void PhotoEditorFrame::PresentBackBuffer()
+{
+    displayBitmap = &outputBuffers[backBuffer];
+    backBuffer = 1 - backBuffer;
+    photoCanvas->Refresh();
+}
+
+void PhotoEditorFrame::ShowFallback(const wxImage& image)
+{
+    fallbackBitmap = wxBitmap(image);
+    displayBitmap = &fallbackBitmap;
+    photoCanvas->Refresh();
+}
+
+void PhotoEditorFrame::OnPaintPhoto(wxPaintEvent& event)
+{
+    wxPaintDC dc(photoCanvas);
+    if (!displayBitmap->IsOk()) {
+        return;
+    }
+
+    wxSize area = photoCanvas->GetClientSize();
+    int x = std::max((area.GetWidth() - displayBitmap->GetWidth()) / 2, 0);
+    int y = std::max((area.GetHeight() - displayBitmap->GetHeight()) / 2, 0);
+    dc.DrawBitmap(*displayBitmap, x, y, true);
+}
+
+bool PhotoEditorFrame::AdjustBrightness(wxBitmap& target, int value)
+{
+    BrightnessOp op = { value };
+    return RenderToBitmap(originalImage, target, op);
+}
+
+bool PhotoEditorFrame::AdjustSaturation(wxBitmap& target, int value)
+{
+    SaturationOp op = { (value + 100.0) / 100.0 };
+    return RenderToBitmap(originalImage, target, op);
+}
+
+bool PhotoEditorFrame::AdjustContrast(wxBitmap& target, int value)
+{
+    ContrastOp op = { (value + 100.0) / 100.0 };
+    return RenderToBitmap(originalImage, target, op);
+}
+
+wxImage PhotoEditorFrame::AdjustBrightness(wxImage image, int value)
+{
+    BrightnessOp op = { value };
+    RenderInPlace(image, op);
+    return image;
+}
+
+wxImage PhotoEditorFrame::AdjustSaturation(wxImage image, int value)
+{
+    SaturationOp op = { (value + 100.0) / 100.0 };
+    RenderInPlace(image, op);
+    return image;
+}
+
+wxImage PhotoEditorFrame::AdjustContrast(wxImage image, int value)
+{
+    ContrastOp op = { (value + 100.0) / 100.0 };
+    RenderInPlace(image, op);
+    return image;
+}
+
+void MyFrame::SaveAlbumData()
+{
+    std::vector<AlbumRecord> records(albumTitles.size());
+    for (size_t i = 0; i < albumTitles.size(); ++i) {
+        records[i].title = albumTitles[i].ToUTF8().data();
+        for (size_t j = 0; j < albumPaths[i].size(); ++j) {
+            records[i].photoPaths.push_back(albumPaths[i][j].ToUTF8().data());
+        }
+    }
+
+    if (!WriteAlbumDataFile(std::string(dataFilePath.mb_str()), records)) {
+        wxMessageBox("Failed to save album data.", "Error", wxOK | wxICON_ERROR);
+    }
+}
+
+void MyFrame::LoadAlbumData()
+{
+    // Convert each photo as soon as its album is decoded and drop the image,
+    // so only one album's worth of decoded pixels is alive next to the bitmaps.
+    bool loaded = LoadAlbumLibrary(dataFilePath, [this](LoadedAlbum& album) {
+        std::vector<wxBitmap> bitmaps;
+        for (size_t i = 0; i < album.photos.size(); ++i) {
+            bitmaps.push_back(wxBitmap(album.photos[i]));
+            album.photos[i] = wxNullImage;
+        }
+        albums.push_back(bitmaps);
+        albumPaths.push_back(album.photoPaths);
+        albumTitles.push_back(album.title);
+    });
+
+    if (!loaded) {
+        return;
+    }
+
+    UpdateAlbumDisplay();
+}
+
+size_t MyFrame::GetPhotoCount() const
+{
+    size_t count = 0;
+    for (size_t i = 0; i < albums.size(); ++i) {
+        count += albums[i].size();
+    }
+    return count;
+}
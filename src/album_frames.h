@@ -0,0 +1,152 @@
+#ifndef ALBUM_FRAMES_H
+#define ALBUM_FRAMES_H
+
+#include <wx/wx.h>
+#include <wx/timer.h>
+#include <wx/slider.h>
+#include <vector>
+
+enum
+{
+    ID_CreateAlbum = 1,
+    ID_AddPhoto = 2,
+    ID_RemovePhoto = 3,
+    ID_Next = 4,
+    ID_Back = 5,
+    ID_Timer = 6,
+    ID_BrightnessSlider = 7,
+    ID_SaturationSlider = 8,
+    ID_ContrastSlider = 9,  
+    ID_UploadPhoto = 10,
+    ID_BackToMain = 11  
+};
+
+class MyFrame : public wxFrame
+{
+public:
+    MyFrame(const wxString& title, const wxString& dataFile);
+
+    void OnCreateAlbum(wxCommandEvent& event);
+    void OnAlbumClick(wxMouseEvent& event);
+    void ShowAlbumPage(const wxString& title, std::vector<wxBitmap>& photos, std::vector<wxString>& photoPaths);
+    void OnAddPhoto(wxCommandEvent& event);
+    void OnRemovePhoto(wxCommandEvent& event);
+    void OnNext(wxCommandEvent& event);
+    void OnBack(wxCommandEvent& event);
+    void OnPhotoClick(wxMouseEvent& event); 
+    void OnPhotoHover(wxMouseEvent& event); 
+    void OnTimer(wxTimerEvent& event);      
+    void ResetPhotoPosition(wxMouseEvent& event);  
+
+    void SaveAlbumData(); 
+    void LoadAlbumData(); 
+
+    size_t GetAlbumCount() const { return albums.size(); }
+    size_t GetPhotoCount() const;
+
+private:
+    wxString dataFilePath;
+    wxBoxSizer* mainSizer;
+    wxBoxSizer* buttonSizer;
+    wxGridSizer* albumGridSizer;
+    wxGridSizer* photoSizer;
+
+    std::vector<wxStaticBitmap*> albumWidgets;
+    std::vector<std::vector<wxBitmap> > albums;  
+    std::vector<std::vector<wxString> > albumPaths; 
+    std::vector<wxString> albumTitles; 
+    std::vector<wxBitmap> currentAlbum;  
+    std::vector<wxString> currentPaths;  
+    wxString currentAlbumTitle;  
+    std::vector<wxStaticBitmap*> photoWidgets;
+    int currentStartIndex;
+
+    wxTimer* hoverTimer;   
+    wxStaticBitmap* hoverPhoto;  
+    int originalY;          
+
+    void UpdateAlbumDisplay();
+    void UpdatePhotoDisplay();
+
+    wxDECLARE_EVENT_TABLE();
+};
+
+class AlbumFrame : public wxFrame
+{
+public:
+    AlbumFrame(const wxString& title, std::vector<wxBitmap>& photos, std::vector<wxString>& photoPaths, MyFrame* parent);
+
+    void OnAddPhoto(wxCommandEvent& event);
+    void OnPhotoClick(wxMouseEvent& event);
+    void OnBackToMain(wxCommandEvent& event);
+
+private:
+    wxBoxSizer* mainSizer;
+    wxGridSizer* photoSizer;
+    std::vector<wxBitmap>& albumPhotos;
+    std::vector<wxString>& albumPhotoPaths;
+    std::vector<wxStaticBitmap*> photoWidgets;
+    MyFrame* parentFrame;  
+
+    void UpdatePhotoDisplay();
+
+    wxDECLARE_EVENT_TABLE();
+};
+
+class CreateAlbumDialog : public wxDialog
+{
+public:
+    CreateAlbumDialog(wxWindow* parent);
+
+    wxString GetAlbumTitle() const { return albumTitle->GetValue(); }
+    wxImage GetAlbumCover() const { return coverPhoto; }
+
+private:
+    wxTextCtrl* albumTitle;
+    wxButton* uploadButton;
+    wxStaticBitmap* photoPreview;  
+    wxImage coverPhoto;
+
+    void OnUploadPhoto(wxCommandEvent& event);
+};
+
+class PhotoEditorFrame : public wxFrame
+{
+public:
+    PhotoEditorFrame(wxBitmap bitmap);
+
+private:
+    wxPanel* photoCanvas;
+    wxBitmap originalBitmap;
+    wxImage originalImage;
+    wxSlider* brightnessSlider;
+    wxSlider* saturationSlider;
+    wxSlider* contrastSlider;  
+
+    // Reused output bitmaps; one is on screen while the other is written.
+    wxBitmap outputBuffers[2];
+    int backBuffer;
+    // Whether the buffers accept raw pixel access; probed once on construction.
+    bool rawAccessOk;
+    wxBitmap fallbackBitmap;
+    // Drawn by OnPaintPhoto: originalBitmap, an output buffer or fallbackBitmap.
+    const wxBitmap* displayBitmap;
+
+    void OnBrightnessChange(wxCommandEvent& event);
+    void OnSaturationChange(wxCommandEvent& event);
+    void OnContrastChange(wxCommandEvent& event);  
+    void OnPaintPhoto(wxPaintEvent& event);
+
+    bool AdjustBrightness(wxBitmap& target, int value);
+    bool AdjustSaturation(wxBitmap& target, int value);
+    bool AdjustContrast(wxBitmap& target, int value);  
+    wxImage AdjustBrightness(wxImage image, int value);
+    wxImage AdjustSaturation(wxImage image, int value);
+    wxImage AdjustContrast(wxImage image, int value);  
+    void PresentBackBuffer();
+    void ShowFallback(const wxImage& image);
+
+    wxDECLARE_EVENT_TABLE();
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include "album_library.h"
+
+bool LoadAlbum(const AlbumRecord& record, LoadedAlbum& album)
+{
+    album.title = wxString::FromUTF8(record.title.c_str());
+    album.photos.clear();
+    album.photoPaths.clear();
+
+    for (size_t i = 0; i < record.photoPaths.size(); ++i) {
+        wxString path = wxString::FromUTF8(record.photoPaths[i].c_str());
+        if (path.empty()) {
+            continue;
+        }
+
+        wxImage image;
+        if (image.LoadFile(path, wxBITMAP_TYPE_ANY) && image.IsOk()) {
+            album.photos.push_back(image);
+            album.photoPaths.push_back(path);
+        }
+    }
+
+    return !album.photos.empty();
+}
+
+bool LoadAlbumLibrary(const wxString& dataFile, const std::function<void(LoadedAlbum&)>& onAlbum)
+{
+    std::vector<AlbumRecord> records;
+    if (!ReadAlbumDataFile(std::string(dataFile.mb_str()), records)) {
+        return false;
+    }
+
+    LoadedAlbum album;
+    for (size_t i = 0; i < records.size(); ++i) {
+        if (LoadAlbum(records[i], album)) {
+            onAlbum(album);
+        }
+    }
+
+    return true;
+}
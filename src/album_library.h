@@ -0,0 +1,30 @@
+#ifndef ALBUM_LIBRARY_H
+#define ALBUM_LIBRARY_H
+
+#include <wx/string.h>
+#include <wx/image.h>
+#include <functional>
+#include <vector>
+
+#include "album_data.h"
+
+// A decoded album. Photos are kept as wxImage so the library can be loaded
+// without a display; MyFrame converts them to wxBitmap for its widgets.
+struct LoadedAlbum
+{
+    wxString title;
+    std::vector<wxImage> photos;
+    std::vector<wxString> photoPaths;
+};
+
+// Decodes every photo of one album record. Photos that fail to load are
+// skipped. Returns false if no photo could be loaded.
+bool LoadAlbum(const AlbumRecord& record, LoadedAlbum& album);
+
+// Reads an album data file and decodes its albums one at a time. Each album
+// with at least one loadable photo is passed to onAlbum before the next one
+// is decoded, so the caller can convert and release its images. Returns
+// false if the data file cannot be read.
+bool LoadAlbumLibrary(const wxString& dataFile, const std::function<void(LoadedAlbum&)>& onAlbum);
+
+#endif
@@ -0,0 +1,116 @@
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "album_data.h"
+
+static int failures = 0;
+
+#define CHECK(condition)                                                  \
+    do {                                                                  \
+        if (!(condition)) {                                               \
+            std::fprintf(stderr, "%s:%d: CHECK failed: %s\n",             \
+                         __FILE__, __LINE__, #condition);                 \
+            ++failures;                                                   \
+        }                                                                 \
+    } while (0)
+
+static std::vector<AlbumRecord> Parse(const std::string& text)
+{
+    std::istringstream in(text);
+    std::vector<AlbumRecord> records;
+    CHECK(ReadAlbumData(in, records));
+    return records;
+}
+
+// The first photo path after a title must not replace the title.
+static void TestTitleIsNotOverwrittenByFirstPhoto()
+{
+    std::vector<AlbumRecord> records = Parse(
+        "Holidays\n"
+        "/photos/beach.jpg\n"
+        "/photos/sunset.png\n"
+        "END_ALBUM\n");
+
+    CHECK(records.size() == 1);
+    if (records.size() != 1) {
+        return;
+    }
+    CHECK(records[0].title == "Holidays");
+    CHECK(records[0].photoPaths.size() == 2);
+    CHECK(records[0].photoPaths.size() == 2 && records[0].photoPaths[0] == "/photos/beach.jpg");
+}
+
+static void TestMultipleAlbums()
+{
+    std::vector<AlbumRecord> records = Parse(
+        "One\n/a.png\nEND_ALBUM\n"
+        "Two\n/b.png\n/c.png\nEND_ALBUM\n"
+        "Empty\nEND_ALBUM\n");
+
+    CHECK(records.size() == 3);
+    if (records.size() != 3) {
+        return;
+    }
+    CHECK(records[1].title == "Two");
+    CHECK(records[1].photoPaths.size() == 2);
+    CHECK(records[2].title == "Empty");
+    CHECK(records[2].photoPaths.empty());
+}
+
+static void TestUnterminatedAlbumIsDropped()
+{
+    std::vector<AlbumRecord> records = Parse("Done\n/a.png\nEND_ALBUM\nPartial\n/b.png\n");
+
+    CHECK(records.size() == 1);
+    CHECK(records.size() == 1 && records[0].title == "Done");
+}
+
+static void TestCrLfLineEndings()
+{
+    std::vector<AlbumRecord> records = Parse("Title\r\n/a.png\r\nEND_ALBUM\r\n");
+
+    CHECK(records.size() == 1);
+    CHECK(records.size() == 1 && records[0].title == "Title");
+    CHECK(records.size() == 1 && records[0].photoPaths.size() == 1 && records[0].photoPaths[0] == "/a.png");
+}
+
+static void TestWriteThenReadRoundTrips()
+{
+    std::vector<AlbumRecord> original(2);
+    original[0].title = "Family";
+    original[0].photoPaths.push_back("/x/1.jpg");
+    original[0].photoPaths.push_back("/x/2.jpg");
+    original[1].title = "Caf\xc3\xa9";
+    original[1].photoPaths.push_back("/y/3.png");
+
+    std::ostringstream out;
+    CHECK(WriteAlbumData(out, original));
+
+    std::vector<AlbumRecord> records = Parse(out.str());
+    CHECK(records.size() == 2);
+    if (records.size() != 2) {
+        return;
+    }
+    CHECK(records[0].title == "Family");
+    CHECK(records[0].photoPaths == original[0].photoPaths);
+    CHECK(records[1].title == original[1].title);
+    CHECK(records[1].photoPaths == original[1].photoPaths);
+}
+
+int main()
+{
+    TestTitleIsNotOverwrittenByFirstPhoto();
+    TestMultipleAlbums();
+    TestUnterminatedAlbumIsDropped();
+    TestCrLfLineEndings();
+    TestWriteThenReadRoundTrips();
+
+    if (failures != 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    std::printf("all album data tests passed\n");
+    return 0;
+}
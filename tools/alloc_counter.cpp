@@ -0,0 +1,76 @@
+// Interposes the glibc allocator entry points so the load harness can count
+// pixel-sized allocations made inside wxWidgets and the toolkit, not just
+// those made through operator new.
+
+#include "alloc_counter.h"
+
+#include <cstdio>
+
+#if defined(__linux__) && defined(__GLIBC__)
+
+#include <atomic>
+
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+}
+
+static std::atomic<bool> counting(false);
+static std::atomic<size_t> countFrom(0);
+static std::atomic<long> allocations(0);
+
+static void NoteAllocation(size_t size)
+{
+    if (counting.load(std::memory_order_relaxed) && size >= countFrom.load(std::memory_order_relaxed)) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+extern "C" {
+
+void* malloc(size_t size) noexcept
+{
+    NoteAllocation(size);
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) noexcept
+{
+    NoteAllocation(count * size);
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, size_t size) noexcept
+{
+    NoteAllocation(size);
+    return __libc_realloc(pointer, size);
+}
+
+}
+
+void StartAllocationCount(size_t minBytes)
+{
+    allocations = 0;
+    countFrom = minBytes;
+    counting = true;
+}
+
+long StopAllocationCount()
+{
+    counting = false;
+    return allocations.load();
+}
+
+#else
+
+void StartAllocationCount(size_t)
+{
+}
+
+long StopAllocationCount()
+{
+    return -1;
+}
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <cstddef>
+
+// Counts malloc/calloc/realloc calls of at least minBytes made by this
+// process and its shared libraries between Start and Stop. Stop returns -1
+// where counting is not supported (only Linux/glibc interposition is
+// implemented).
+void StartAllocationCount(size_t minBytes);
+long StopAllocationCount();
+
+#endif
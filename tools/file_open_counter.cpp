@@ -0,0 +1,124 @@
+// Interposes the libc open family so the load harness can count how many
+// files the load path opens, including those opened inside wxWidgets.
+// CMake builds it without the wx flags, so open and open64 are normally
+// distinct symbols. Under _FILE_OFFSET_BITS=64 glibc maps open to open64, and
+// only the names it leaves distinct are defined.
+
+#include "file_open_counter.h"
+
+#include <cstdio>
+
+#if defined(__linux__) && defined(__GLIBC__)
+
+#include <atomic>
+#include <cstdarg>
+#include <dlfcn.h>
+#include <fcntl.h>
+
+static std::atomic<long> fileOpens(0);
+
+template <class Fn>
+static Fn NextSymbol(const char* name)
+{
+    return reinterpret_cast<Fn>(dlsym(RTLD_NEXT, name));
+}
+
+static bool NeedsMode(int flags)
+{
+#ifdef O_TMPFILE
+    return (flags & O_CREAT) != 0 || (flags & O_TMPFILE) == O_TMPFILE;
+#else
+    return (flags & O_CREAT) != 0;
+#endif
+}
+
+extern "C" {
+
+int open(const char* path, int flags, ...)
+{
+    typedef int (*OpenFn)(const char*, int, ...);
+    static OpenFn next = NextSymbol<OpenFn>("open");
+
+    mode_t mode = 0;
+    if (NeedsMode(flags)) {
+        va_list args;
+        va_start(args, flags);
+        mode = va_arg(args, mode_t);
+        va_end(args);
+    }
+
+    ++fileOpens;
+    return next(path, flags, mode);
+}
+
+#if !defined(_FILE_OFFSET_BITS) || _FILE_OFFSET_BITS != 64
+int open64(const char* path, int flags, ...)
+{
+    typedef int (*OpenFn)(const char*, int, ...);
+    static OpenFn next = NextSymbol<OpenFn>("open64");
+
+    mode_t mode = 0;
+    if (NeedsMode(flags)) {
+        va_list args;
+        va_start(args, flags);
+        mode = va_arg(args, mode_t);
+        va_end(args);
+    }
+
+    ++fileOpens;
+    return next(path, flags, mode);
+}
+#endif
+
+int openat(int dirfd, const char* path, int flags, ...)
+{
+    typedef int (*OpenAtFn)(int, const char*, int, ...);
+    static OpenAtFn next = NextSymbol<OpenAtFn>("openat");
+
+    mode_t mode = 0;
+    if (NeedsMode(flags)) {
+        va_list args;
+        va_start(args, flags);
+        mode = va_arg(args, mode_t);
+        va_end(args);
+    }
+
+    ++fileOpens;
+    return next(dirfd, path, flags, mode);
+}
+
+FILE* fopen(const char* path, const char* modeString)
+{
+    typedef FILE* (*FopenFn)(const char*, const char*);
+    static FopenFn next = NextSymbol<FopenFn>("fopen");
+
+    ++fileOpens;
+    return next(path, modeString);
+}
+
+#if !defined(_FILE_OFFSET_BITS) || _FILE_OFFSET_BITS != 64
+FILE* fopen64(const char* path, const char* modeString)
+{
+    typedef FILE* (*FopenFn)(const char*, const char*);
+    static FopenFn next = NextSymbol<FopenFn>("fopen64");
+
+    ++fileOpens;
+    return next(path, modeString);
+}
+#endif
+
+}
+
+long FileOpenCount()
+{
+    return fileOpens.load();
+}
+
+#else
+
+long FileOpenCount()
+{
+    return -1;
+}
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef FILE_OPEN_COUNTER_H
+#define FILE_OPEN_COUNTER_H
+
+// Number of open/fopen calls made by this process and the shared libraries
+// it loads, or -1 where the counter is not supported (only Linux/glibc
+// interposition is implemented).
+long FileOpenCount();
+
+#endif
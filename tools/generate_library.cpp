@@ -0,0 +1,308 @@
+// Writes a synthetic photo library: an album_data.txt plus N albums of M
+// generated photos each, so load performance can be measured at
+// production-like sizes without real image files.
+//
+// bmp and ppm are written directly. png and jpg need the wxWidgets image
+// handlers and are only available when built with GENERATOR_WITH_WX.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "album_data.h"
+
+#ifdef GENERATOR_WITH_WX
+#include <wx/init.h>
+#include <wx/image.h>
+#endif
+
+namespace fs = std::filesystem;
+
+struct PhotoSize
+{
+    int width;
+    int height;
+};
+
+struct Options
+{
+    std::string outDir;
+    int albums = 10;
+    int photos = 20;
+    std::vector<PhotoSize> sizes;
+    std::vector<std::string> formats;
+    unsigned seed = 1;
+};
+
+static std::vector<std::string> SplitList(const std::string& text)
+{
+    std::vector<std::string> items;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+static bool ParseSizes(const std::string& text, std::vector<PhotoSize>& sizes)
+{
+    std::vector<std::string> items = SplitList(text);
+    for (size_t i = 0; i < items.size(); ++i) {
+        PhotoSize size;
+        if (std::sscanf(items[i].c_str(), "%dx%d", &size.width, &size.height) != 2 ||
+            size.width <= 0 || size.height <= 0) {
+            return false;
+        }
+        sizes.push_back(size);
+    }
+    return !sizes.empty();
+}
+
+static bool IsSupportedFormat(const std::string& format)
+{
+    if (format == "bmp" || format == "ppm") {
+        return true;
+    }
+#ifdef GENERATOR_WITH_WX
+    if (format == "png" || format == "jpg") {
+        return true;
+    }
+#endif
+    return false;
+}
+
+static void PrintUsage()
+{
+    std::fprintf(stderr,
+        "usage: generate_library <out-dir> [--albums N] [--photos M]\n"
+        "                        [--size WxH[,WxH...]] [--format FMT[,FMT...]] [--seed S]\n"
+#ifdef GENERATOR_WITH_WX
+        "formats: bmp, ppm, png, jpg\n"
+#else
+        "formats: bmp, ppm\n"
+#endif
+        "sizes cycle per photo; formats advance after each full pass over the sizes.\n");
+}
+
+static bool ParseOptions(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--albums" && hasValue) {
+            options.albums = std::atoi(argv[++i]);
+        } else if (arg == "--photos" && hasValue) {
+            options.photos = std::atoi(argv[++i]);
+        } else if (arg == "--size" && hasValue) {
+            if (!ParseSizes(argv[++i], options.sizes)) {
+                return false;
+            }
+        } else if (arg == "--format" && hasValue) {
+            options.formats = SplitList(argv[++i]);
+        } else if (arg == "--seed" && hasValue) {
+            options.seed = unsigned(std::strtoul(argv[++i], NULL, 10));
+        } else if (arg[0] != '-' && options.outDir.empty()) {
+            options.outDir = arg;
+        } else {
+            return false;
+        }
+    }
+
+    if (options.sizes.empty()) {
+        options.sizes.push_back(PhotoSize{640, 480});
+    }
+    if (options.formats.empty()) {
+        options.formats.push_back("bmp");
+    }
+    for (size_t i = 0; i < options.formats.size(); ++i) {
+        if (!IsSupportedFormat(options.formats[i])) {
+            std::fprintf(stderr, "unsupported format: %s\n", options.formats[i].c_str());
+            return false;
+        }
+    }
+
+    return !options.outDir.empty() && options.albums >= 0 && options.photos >= 0;
+}
+
+// Gradient plus noise, so the pixels are neither constant nor trivially
+// compressible.
+static void FillPixels(std::vector<unsigned char>& rgb, const PhotoSize& size, unsigned& state)
+{
+    rgb.resize(size_t(size.width) * size.height * 3);
+    size_t i = 0;
+    for (int y = 0; y < size.height; ++y) {
+        for (int x = 0; x < size.width; ++x) {
+            state = state * 1664525u + 1013904223u;
+            unsigned noise = (state >> 24) & 0x1f;
+            rgb[i++] = (unsigned char)((x * 255 / size.width + noise) & 0xff);
+            rgb[i++] = (unsigned char)((y * 255 / size.height + noise) & 0xff);
+            rgb[i++] = (unsigned char)(((x + y) & 0xff) ^ noise);
+        }
+    }
+}
+
+static void PutLE(std::ofstream& out, unsigned value, int bytes)
+{
+    for (int i = 0; i < bytes; ++i) {
+        out.put(char((value >> (8 * i)) & 0xff));
+    }
+}
+
+static bool WriteBmp(const std::string& path, const std::vector<unsigned char>& rgb, const PhotoSize& size)
+{
+    std::ofstream out(path.c_str(), std::ios::binary);
+    if (!out.is_open()) {
+        return false;
+    }
+
+    unsigned rowBytes = (unsigned(size.width) * 3 + 3) & ~3u;
+    unsigned imageBytes = rowBytes * unsigned(size.height);
+
+    out.put('B');
+    out.put('M');
+    PutLE(out, 54 + imageBytes, 4);
+    PutLE(out, 0, 4);
+    PutLE(out, 54, 4);
+    PutLE(out, 40, 4);
+    PutLE(out, unsigned(size.width), 4);
+    PutLE(out, unsigned(size.height), 4);
+    PutLE(out, 1, 2);
+    PutLE(out, 24, 2);
+    PutLE(out, 0, 4);
+    PutLE(out, imageBytes, 4);
+    PutLE(out, 2835, 4);
+    PutLE(out, 2835, 4);
+    PutLE(out, 0, 4);
+    PutLE(out, 0, 4);
+
+    std::vector<char> row(rowBytes, 0);
+    for (int y = size.height - 1; y >= 0; --y) {
+        const unsigned char* src = &rgb[size_t(y) * size.width * 3];
+        for (int x = 0; x < size.width; ++x) {
+            row[x * 3] = char(src[x * 3 + 2]);
+            row[x * 3 + 1] = char(src[x * 3 + 1]);
+            row[x * 3 + 2] = char(src[x * 3]);
+        }
+        out.write(&row[0], row.size());
+    }
+
+    return out.good();
+}
+
+static bool WritePpm(const std::string& path, const std::vector<unsigned char>& rgb, const PhotoSize& size)
+{
+    std::ofstream out(path.c_str(), std::ios::binary);
+    if (!out.is_open()) {
+        return false;
+    }
+
+    out << "P6\n" << size.width << " " << size.height << "\n255\n";
+    out.write(reinterpret_cast<const char*>(&rgb[0]), rgb.size());
+    return out.good();
+}
+
+#ifdef GENERATOR_WITH_WX
+static bool WriteWithWx(const std::string& path, std::vector<unsigned char>& rgb,
+                        const PhotoSize& size, wxBitmapType type)
+{
+    wxImage image(size.width, size.height, &rgb[0], true);
+    return image.SaveFile(wxString::FromUTF8(path.c_str()), type);
+}
+#endif
+
+static bool WritePhoto(const std::string& path, const std::string& format,
+                       std::vector<unsigned char>& rgb, const PhotoSize& size)
+{
+    if (format == "bmp") {
+        return WriteBmp(path, rgb, size);
+    }
+    if (format == "ppm") {
+        return WritePpm(path, rgb, size);
+    }
+#ifdef GENERATOR_WITH_WX
+    if (format == "png") {
+        return WriteWithWx(path, rgb, size, wxBITMAP_TYPE_PNG);
+    }
+    if (format == "jpg") {
+        return WriteWithWx(path, rgb, size, wxBITMAP_TYPE_JPEG);
+    }
+#endif
+    return false;
+}
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 2;
+    }
+
+#ifdef GENERATOR_WITH_WX
+    wxInitializer initializer;
+    if (!initializer.IsOk()) {
+        std::fprintf(stderr, "failed to initialise wxWidgets\n");
+        return 1;
+    }
+    wxInitAllImageHandlers();
+#endif
+
+    fs::path outDir = fs::absolute(options.outDir);
+    std::error_code error;
+    fs::create_directories(outDir, error);
+    if (error) {
+        std::fprintf(stderr, "cannot create %s: %s\n", outDir.string().c_str(), error.message().c_str());
+        return 1;
+    }
+
+    std::vector<AlbumRecord> records;
+    std::vector<unsigned char> rgb;
+    unsigned state = options.seed;
+    size_t photoIndex = 0;
+
+    for (int a = 0; a < options.albums; ++a) {
+        AlbumRecord record;
+        record.title = "Album " + std::to_string(a + 1);
+
+        fs::path albumDir = outDir / ("album_" + std::to_string(a + 1));
+        fs::create_directories(albumDir, error);
+        if (error) {
+            std::fprintf(stderr, "cannot create %s: %s\n", albumDir.string().c_str(), error.message().c_str());
+            return 1;
+        }
+
+        for (int p = 0; p < options.photos; ++p, ++photoIndex) {
+            const PhotoSize& size = options.sizes[photoIndex % options.sizes.size()];
+            size_t pass = photoIndex / options.sizes.size();
+            const std::string& format = options.formats[pass % options.formats.size()];
+            std::string path = (albumDir / ("photo_" + std::to_string(p + 1) + "." + format)).string();
+
+            FillPixels(rgb, size, state);
+            if (!WritePhoto(path, format, rgb, size)) {
+                std::fprintf(stderr, "failed to write %s\n", path.c_str());
+                return 1;
+            }
+            record.photoPaths.push_back(path);
+        }
+
+        records.push_back(record);
+    }
+
+    std::string dataFile = (outDir / "album_data.txt").string();
+    if (!WriteAlbumDataFile(dataFile, records)) {
+        std::fprintf(stderr, "failed to write %s\n", dataFile.c_str());
+        return 1;
+    }
+
+    std::printf("wrote %d albums x %d photos to %s\n", options.albums, options.photos, dataFile.c_str());
+    return 0;
+}
@@ -0,0 +1,281 @@
+// Startup benchmark. Builds the app's real MyFrame against a data file,
+// prints the metrics below and exits non-zero when any of them exceeds its
+// threshold.
+//
+//   loaded_ms       time for the MyFrame constructor, which loads and
+//                   converts every album and builds the album grid
+//   first_frame_ms  time until the first idle event after Show, with
+//                   pending paints flushed by Update()
+//   peak_rss_kb     peak resident set size of the process
+//   file_opens      open/fopen calls made while the frame loads (Linux only)
+//   editor_allocs   allocations of at least one byte per pixel made while
+//                   PhotoEditorFrame renders and paints slider ticks, after
+//                   warm-up (Linux only); any full-frame buffer is counted
+//
+// MyFrame creates real windows, so on X11 this needs a display; CMake runs
+// it under xvfb-run when that is available.
+
+#include <wx/wx.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <sys/resource.h>
+
+#include "album_data.h"
+#include "album_frames.h"
+#include "alloc_counter.h"
+#include "file_open_counter.h"
+
+static const int EDITOR_WARM_UP_TICKS = 4;
+static const int EDITOR_MEASURED_TICKS = 20;
+
+struct Thresholds
+{
+    double maxFirstFrameMs = -1;
+    double maxLoadedMs = -1;
+    long maxPeakRssKb = -1;
+    long maxFileOpens = -1;
+    long expectAlbums = -1;
+    long expectPhotos = -1;
+    long maxEditorAllocs = -1;
+};
+
+static void PrintUsage()
+{
+    std::fprintf(stderr,
+        "usage: load_harness <album_data.txt> [--max-first-frame-ms MS] [--max-loaded-ms MS]\n"
+        "                    [--max-peak-rss-kb KB] [--max-file-opens N]\n"
+        "                    [--expect-albums N] [--expect-photos N]\n"
+        "                    [--max-editor-allocs N]\n");
+}
+
+static long PeakRssKb()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return -1;
+    }
+#ifdef __APPLE__
+    return long(usage.ru_maxrss / 1024);
+#else
+    return long(usage.ru_maxrss);
+#endif
+}
+
+static double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Moves the slider the way a drag does: set the value, send the slider event
+// to the editor's handler, then paint synchronously.
+static void SlideTo(wxWindow* editor, wxSlider* slider, int value)
+{
+    slider->SetValue(value);
+    wxCommandEvent event(wxEVT_SLIDER, slider->GetId());
+    event.SetEventObject(slider);
+    event.SetInt(value);
+    slider->ProcessWindowEvent(event);
+    editor->Update();
+}
+
+static bool CheckLimit(const char* name, double value, double limit)
+{
+    if (limit < 0 || value <= limit) {
+        return true;
+    }
+    std::fprintf(stderr, "REGRESSION: %s = %.1f exceeds limit %.1f\n", name, value, limit);
+    return false;
+}
+
+static bool CheckExpected(const char* name, long value, long expected)
+{
+    if (expected < 0 || value == expected) {
+        return true;
+    }
+    std::fprintf(stderr, "FAILED: %s = %ld, expected %ld\n", name, value, expected);
+    return false;
+}
+
+class LoadHarnessApp : public wxApp
+{
+public:
+    virtual bool OnInit();
+    virtual int OnRun();
+
+private:
+    wxString dataFile;
+    Thresholds limits;
+    MyFrame* frame;
+    std::chrono::steady_clock::time_point start;
+    double loadedMs;
+    long fileOpens;
+    int exitCode;
+
+    bool ParseArguments();
+    void WarmUpToolkit();
+    bool CountEditorAllocations(long& allocations);
+    void OnFirstIdle(wxIdleEvent& event);
+};
+
+wxIMPLEMENT_APP(LoadHarnessApp);
+
+bool LoadHarnessApp::ParseArguments()
+{
+    if (argc < 2) {
+        return false;
+    }
+
+    dataFile = argv[1];
+    for (int i = 2; i < argc; ++i) {
+        if (i + 1 >= argc) {
+            return false;
+        }
+        wxString flag = argv[i];
+        wxString value = argv[++i];
+        double number;
+        if (!value.ToDouble(&number)) {
+            return false;
+        }
+
+        if (flag == "--max-first-frame-ms") {
+            limits.maxFirstFrameMs = number;
+        } else if (flag == "--max-loaded-ms") {
+            limits.maxLoadedMs = number;
+        } else if (flag == "--max-peak-rss-kb") {
+            limits.maxPeakRssKb = long(number);
+        } else if (flag == "--max-file-opens") {
+            limits.maxFileOpens = long(number);
+        } else if (flag == "--expect-albums") {
+            limits.expectAlbums = long(number);
+        } else if (flag == "--expect-photos") {
+            limits.expectPhotos = long(number);
+        } else if (flag == "--max-editor-allocs") {
+            limits.maxEditorAllocs = long(number);
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// The first top-level window makes the toolkit load its themes and fonts;
+// do that before measuring so it is not charged to the load path.
+void LoadHarnessApp::WarmUpToolkit()
+{
+    wxFrame* warmUp = new wxFrame(NULL, wxID_ANY, "Warm-up");
+    new wxButton(warmUp, wxID_ANY, "Warm-up");
+    warmUp->Show();
+    warmUp->Update();
+    warmUp->Destroy();
+}
+
+// Opens the real PhotoEditorFrame on the library's first photo and drags the
+// brightness slider back and forth.
+bool LoadHarnessApp::CountEditorAllocations(long& allocations)
+{
+    std::vector<AlbumRecord> records;
+    if (!ReadAlbumDataFile(std::string(dataFile.mb_str()), records) ||
+        records.empty() || records[0].photoPaths.empty()) {
+        std::fprintf(stderr, "no photo to open in the editor\n");
+        return false;
+    }
+
+    wxBitmap photo;
+    if (!photo.LoadFile(wxString::FromUTF8(records[0].photoPaths[0].c_str()), wxBITMAP_TYPE_ANY)) {
+        std::fprintf(stderr, "cannot load %s\n", records[0].photoPaths[0].c_str());
+        return false;
+    }
+
+    PhotoEditorFrame* editor = new PhotoEditorFrame(photo);
+    editor->Show();
+    editor->Update();
+    wxSlider* slider = static_cast<wxSlider*>(editor->FindWindow(ID_BrightnessSlider));
+
+    // Both buffers are drawn at least once before counting, so one-off
+    // native surface creation is not charged to steady-state dragging.
+    for (int i = 1; i <= EDITOR_WARM_UP_TICKS; ++i) {
+        SlideTo(editor, slider, i);
+    }
+
+    StartAllocationCount(size_t(photo.GetWidth()) * size_t(photo.GetHeight()));
+    for (int i = 0; i < EDITOR_MEASURED_TICKS; ++i) {
+        SlideTo(editor, slider, i % 2 == 0 ? -10 - i : 10 + i);
+    }
+    allocations = StopAllocationCount();
+
+    editor->Destroy();
+    return true;
+}
+
+bool LoadHarnessApp::OnInit()
+{
+    exitCode = 1;
+    if (!ParseArguments()) {
+        PrintUsage();
+        return false;
+    }
+
+    wxInitAllImageHandlers();
+    delete wxLog::SetActiveTarget(new wxLogStderr);
+    WarmUpToolkit();
+
+    long opensBefore = FileOpenCount();
+    start = std::chrono::steady_clock::now();
+
+    frame = new MyFrame("Photo Albums", dataFile);
+
+    loadedMs = MillisecondsSince(start);
+    fileOpens = opensBefore < 0 ? -1 : FileOpenCount() - opensBefore;
+
+    frame->Show(true);
+    Bind(wxEVT_IDLE, &LoadHarnessApp::OnFirstIdle, this);
+    return true;
+}
+
+void LoadHarnessApp::OnFirstIdle(wxIdleEvent& event)
+{
+    Unbind(wxEVT_IDLE, &LoadHarnessApp::OnFirstIdle, this);
+    frame->Update();
+    double firstFrameMs = MillisecondsSince(start);
+
+    long albumCount = long(frame->GetAlbumCount());
+    long photoCount = long(frame->GetPhotoCount());
+    long peakRssKb = PeakRssKb();
+
+    long editorAllocs = -1;
+    bool editorOk = CountEditorAllocations(editorAllocs);
+
+    std::printf("albums=%ld\n", albumCount);
+    std::printf("photos=%ld\n", photoCount);
+    std::printf("loaded_ms=%.1f\n", loadedMs);
+    std::printf("first_frame_ms=%.1f\n", firstFrameMs);
+    std::printf("peak_rss_kb=%ld\n", peakRssKb);
+    std::printf("file_opens=%ld\n", fileOpens);
+    std::printf("editor_allocs=%ld\n", editorAllocs);
+
+    bool ok = editorOk;
+    ok = CheckExpected("albums", albumCount, limits.expectAlbums) && ok;
+    ok = CheckExpected("photos", photoCount, limits.expectPhotos) && ok;
+    ok = CheckLimit("loaded_ms", loadedMs, limits.maxLoadedMs) && ok;
+    ok = CheckLimit("first_frame_ms", firstFrameMs, limits.maxFirstFrameMs) && ok;
+    ok = CheckLimit("peak_rss_kb", double(peakRssKb), double(limits.maxPeakRssKb)) && ok;
+    if (fileOpens >= 0) {
+        ok = CheckLimit("file_opens", double(fileOpens), double(limits.maxFileOpens)) && ok;
+    }
+    if (editorAllocs >= 0) {
+        ok = CheckLimit("editor_allocs", double(editorAllocs), double(limits.maxEditorAllocs)) && ok;
+    }
+
+    exitCode = ok ? 0 : 1;
+    frame->Destroy();
+}
+
+int LoadHarnessApp::OnRun()
+{
+    wxApp::OnRun();
+    return exitCode;
+}